@@ -15,6 +15,7 @@
     // Override point for customization after application launch.
     
     YI13N *yi13n = [YI13N sharedInstance];
+    [yi13n setDelegate:self];
     [yi13n startWithBufferType:YI13NEventBufferTypeInMemory andConfig:@{
         YI13NConfigOptionYWAProjectID: @"557313379",
         YI13NConfigOptionAppSpaceid: @"985574831",